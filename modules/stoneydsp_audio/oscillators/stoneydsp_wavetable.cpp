@@ -0,0 +1,402 @@
+/***************************************************************************//**
+ * @file stoneydsp_wavetable.cpp
+ * @author Nathan J. Hood <nathanjhood@googlemail.com>
+ * @brief Shared, mipmapped band-limited wavetables and a multi-voice
+ * wavetable oscillator bank.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+namespace StoneyDSP
+{
+namespace Audio
+{
+
+//==============================================================================
+WavetableMipMap::WavetableMipMap (const float* sourceCycle, int numSamples)
+    : tableSize (numSamples),
+      tableOrder (0),
+      numLevels (0),
+      hash (computeHash (sourceCycle, numSamples)),
+      source (sourceCycle, sourceCycle + numSamples)
+{
+    jassert (sourceCycle != nullptr && isValidTableSize (numSamples));
+
+    while ((1 << tableOrder) < tableSize)
+        ++tableOrder;
+
+    // Level k keeps harmonics 1 ... N / 2^(k + 1); the last level is a sine.
+    numLevels = tableOrder;
+
+    const auto stride = static_cast<size_t> (getLevelStride());
+    tables.assign (stride * static_cast<size_t> (numLevels), 0.0f);
+
+    juce::dsp::FFT fft (tableOrder);
+
+    std::vector<float> spectrum (static_cast<size_t> (2 * tableSize), 0.0f);
+    std::copy (source.begin(), source.end(), spectrum.begin());
+    fft.performRealOnlyForwardTransform (spectrum.data());
+
+    std::vector<float> work (spectrum.size());
+
+    for (int level = 0; level < numLevels; ++level)
+    {
+        // The Nyquist bin is always dropped, so level 0 stops one short of it.
+        const auto numHarmonics = juce::jmin (tableSize >> (level + 1), (tableSize / 2) - 1);
+
+        std::copy (spectrum.begin(), spectrum.end(), work.begin());
+        std::fill (work.begin() + 2 * (numHarmonics + 1), work.end(), 0.0f);
+
+        fft.performRealOnlyInverseTransform (work.data());
+
+        auto* dest = tables.data() + stride * static_cast<size_t> (level);
+        std::copy (work.begin(), work.begin() + tableSize, dest);
+        dest[tableSize] = dest[0];
+    }
+}
+
+bool WavetableMipMap::isValidTableSize (int numSamples) noexcept
+{
+    // The upper bound keeps (32 - tableOrder) fractional bits for the
+    // fixed-point phase reads.
+    return numSamples >= minTableSize && numSamples <= maxTableSize && juce::isPowerOfTwo (numSamples);
+}
+
+const float* WavetableMipMap::getLevel (int level) const noexcept
+{
+    jassert (juce::isPositiveAndBelow (level, numLevels));
+    return tables.data() + static_cast<size_t> (getLevelStride()) * static_cast<size_t> (level);
+}
+
+int WavetableMipMap::getLevelForIncrement (double cyclesPerSample) const noexcept
+{
+    // Level k holds N / 2^(k + 1) harmonics, which all stay below Nyquist
+    // once 2^k >= N * cyclesPerSample.
+    const auto harmonicsAtNyquist = static_cast<double> (tableSize) * cyclesPerSample;
+
+    if (! (harmonicsAtNyquist > 1.0))
+        return 0;
+
+    return juce::jlimit (0, numLevels - 1, static_cast<int> (std::ceil (std::log2 (harmonicsAtNyquist))));
+}
+
+bool WavetableMipMap::matches (const float* sourceCycle, int numSamples) const noexcept
+{
+    return numSamples == tableSize
+        && std::memcmp (sourceCycle, source.data(), sizeof (float) * static_cast<size_t> (numSamples)) == 0;
+}
+
+std::uint64_t WavetableMipMap::computeHash (const float* sourceCycle, int numSamples) noexcept
+{
+    constexpr std::uint64_t prime = 1099511628211ull;
+    std::uint64_t result = 14695981039346656037ull;
+
+    const auto mix = [&result] (std::uint32_t word)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            result ^= (word >> (8 * i)) & 0xffu;
+            result *= prime;
+        }
+    };
+
+    mix (static_cast<std::uint32_t> (numSamples));
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        std::uint32_t bits;
+        std::memcpy (&bits, sourceCycle + i, sizeof (bits));
+        mix (bits);
+    }
+
+    return result;
+}
+
+//==============================================================================
+std::shared_ptr<const WavetableMipMap> WavetableCache::getOrCreate (const float* sourceCycle, int numSamples)
+{
+    if (sourceCycle == nullptr || ! WavetableMipMap::isValidTableSize (numSamples))
+        return nullptr;
+
+    const auto hash = WavetableMipMap::computeHash (sourceCycle, numSamples);
+
+    const juce::ScopedLock sl (lock);
+
+    removeExpiredEntries();
+
+    const auto range = entries.equal_range (hash);
+
+    for (auto it = range.first; it != range.second; ++it)
+        if (auto existing = it->second.lock())
+            if (existing->matches (sourceCycle, numSamples))
+                return existing;
+
+    // Built under the lock, so two instances asking for the same cycle at
+    // the same time still only build it once.
+    std::shared_ptr<const WavetableMipMap> created (new WavetableMipMap (sourceCycle, numSamples));
+    entries.emplace (hash, created);
+    return created;
+}
+
+std::shared_ptr<const WavetableMipMap> WavetableCache::getOrCreate (const std::function<float (double)>& function, int tableSize)
+{
+    if (! function || ! WavetableMipMap::isValidTableSize (tableSize))
+        return nullptr;
+
+    std::vector<float> cycle (static_cast<size_t> (tableSize));
+
+    for (int i = 0; i < tableSize; ++i)
+        cycle[static_cast<size_t> (i)] = function (static_cast<double> (i) / static_cast<double> (tableSize));
+
+    return getOrCreate (cycle.data(), tableSize);
+}
+
+int WavetableCache::getNumTables() const
+{
+    const juce::ScopedLock sl (lock);
+
+    return static_cast<int> (std::count_if (entries.begin(), entries.end(),
+                                            [] (const auto& entry) { return ! entry.second.expired(); }));
+}
+
+void WavetableCache::removeExpiredEntries()
+{
+    for (auto it = entries.begin(); it != entries.end();)
+        it = it->second.expired() ? entries.erase (it) : std::next (it);
+}
+
+//==============================================================================
+void WavetableOscillatorBank::prepare (double newSampleRate, int maxVoices)
+{
+    jassert (newSampleRate > 0.0);
+    jassert (maxVoices >= 0);
+
+    sampleRate = newSampleRate;
+    numVoices = ((maxVoices + laneSize - 1) / laneSize) * laneSize;
+
+    const auto size = static_cast<size_t> (numVoices);
+
+    frequencies.assign (size, 0.0f);
+    gains.assign (size, 0.0f);
+    phases.assign (size, 0u);
+    increments.assign (size, 0u);
+    levelOffsets.assign (size, 0u);
+
+    numActiveGroups = 0;
+}
+
+void WavetableOscillatorBank::reset() noexcept
+{
+    std::fill (frequencies.begin(), frequencies.end(), 0.0f);
+    std::fill (gains.begin(), gains.end(), 0.0f);
+    std::fill (phases.begin(), phases.end(), 0u);
+    std::fill (increments.begin(), increments.end(), 0u);
+    std::fill (levelOffsets.begin(), levelOffsets.end(), 0u);
+
+    numActiveGroups = 0;
+}
+
+void WavetableOscillatorBank::setWavetable (std::shared_ptr<const WavetableMipMap> newTables)
+{
+    tables = std::move (newTables);
+
+    for (int voice = 0; voice < numVoices; ++voice)
+        updateVoice (voice);
+}
+
+void WavetableOscillatorBank::startVoice (int voice, float frequencyHz, float gain, float startPhase) noexcept
+{
+    jassert (juce::isPositiveAndBelow (voice, numVoices));
+
+    const auto wrappedPhase = static_cast<double> (startPhase) - std::floor (static_cast<double> (startPhase));
+
+    phases[static_cast<size_t> (voice)] = static_cast<std::uint32_t> (wrappedPhase * 4294967296.0);
+    frequencies[static_cast<size_t> (voice)] = frequencyHz;
+    gains[static_cast<size_t> (voice)] = gain;
+
+    updateVoice (voice);
+    updateNumActiveGroups();
+}
+
+void WavetableOscillatorBank::stopVoice (int voice) noexcept
+{
+    setGain (voice, 0.0f);
+}
+
+void WavetableOscillatorBank::setFrequency (int voice, float frequencyHz) noexcept
+{
+    jassert (juce::isPositiveAndBelow (voice, numVoices));
+
+    frequencies[static_cast<size_t> (voice)] = frequencyHz;
+    updateVoice (voice);
+}
+
+void WavetableOscillatorBank::setGain (int voice, float gain) noexcept
+{
+    jassert (juce::isPositiveAndBelow (voice, numVoices));
+
+    gains[static_cast<size_t> (voice)] = gain;
+    updateNumActiveGroups();
+}
+
+bool WavetableOscillatorBank::isVoiceActive (int voice) const noexcept
+{
+    jassert (juce::isPositiveAndBelow (voice, numVoices));
+
+    return ! juce::exactlyEqual (gains[static_cast<size_t> (voice)], 0.0f);
+}
+
+void WavetableOscillatorBank::updateVoice (int voice) noexcept
+{
+    const auto index = static_cast<size_t> (voice);
+    const auto cyclesPerSample = juce::jlimit (-0.5, 0.5, static_cast<double> (frequencies[index]) / sampleRate);
+
+    if (tables == nullptr || ! (std::abs (cyclesPerSample) > 0.0))
+    {
+        increments[index] = 0u;
+        levelOffsets[index] = 0u;
+        return;
+    }
+
+    const auto level = tables->getLevelForIncrement (std::abs (cyclesPerSample));
+
+    // A negative increment is stored in two's complement, so the wrapping
+    // phase simply runs backwards.
+    const auto signedIncrement = juce::jlimit (-2147483648.0, 2147483647.0, cyclesPerSample * 4294967296.0);
+
+    increments[index] = static_cast<std::uint32_t> (static_cast<std::int32_t> (signedIncrement));
+    levelOffsets[index] = static_cast<std::uint32_t> (level * tables->getLevelStride());
+}
+
+void WavetableOscillatorBank::updateNumActiveGroups() noexcept
+{
+    auto highest = numVoices - 1;
+
+    while (highest >= 0 && juce::exactlyEqual (gains[static_cast<size_t> (highest)], 0.0f))
+        --highest;
+
+    numActiveGroups = (highest + laneSize) / laneSize;
+}
+
+void WavetableOscillatorBank::renderNextBlock (juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples) noexcept
+{
+    jassert (startSample >= 0 && startSample + numSamples <= outputBuffer.getNumSamples());
+
+    if (tables == nullptr || numActiveGroups == 0)
+        return;
+
+    constexpr int chunkSize = 256;
+    float chunk[chunkSize];
+
+    for (int offset = 0; offset < numSamples; offset += chunkSize)
+    {
+        const auto numThisTime = juce::jmin (chunkSize, numSamples - offset);
+
+        juce::FloatVectorOperations::clear (chunk, numThisTime);
+        renderNextBlock (chunk, numThisTime);
+
+        for (int channel = 0; channel < outputBuffer.getNumChannels(); ++channel)
+            juce::FloatVectorOperations::add (outputBuffer.getWritePointer (channel, startSample + offset), chunk, numThisTime);
+    }
+}
+
+void WavetableOscillatorBank::renderNextBlock (float* output, int numSamples) noexcept
+{
+    if (tables == nullptr || numActiveGroups == 0)
+        return;
+
+    const auto* table = tables->getData();
+    const auto shift = static_cast<std::uint32_t> (32 - tables->getTableOrder());
+    const auto fractionMask = (std::uint32_t { 1 } << shift) - 1u;
+    const auto fractionScale = 1.0f / static_cast<float> (std::uint32_t { 1 } << shift);
+
+    // Each sub-block is rendered in four passes over (sample, lane) pairs,
+    // so that every pass but the table gather is a plain streaming loop the
+    // compiler can vectorise across voices.
+    constexpr int numValues = subBlockSize * laneSize;
+
+    alignas (32) std::uint32_t phase[laneSize], increment[laneSize], levelOffset[laneSize], index[numValues];
+    alignas (32) float gain[laneSize], fraction[numValues], a[numValues], b[numValues];
+
+    for (int group = 0; group < numActiveGroups; ++group)
+    {
+        const auto base = static_cast<size_t> (group * laneSize);
+
+        std::copy_n (phases.data() + base, laneSize, phase);
+        std::copy_n (increments.data() + base, laneSize, increment);
+        std::copy_n (levelOffsets.data() + base, laneSize, levelOffset);
+        std::copy_n (gains.data() + base, laneSize, gain);
+
+        for (int start = 0; start < numSamples; start += subBlockSize)
+        {
+            const auto numThisTime = juce::jmin (subBlockSize, numSamples - start);
+            const auto numThisTimeValues = numThisTime * laneSize;
+
+            // 1. Read positions and interpolation fractions.
+            for (int i = 0; i < numThisTime; ++i)
+            {
+                for (int lane = 0; lane < laneSize; ++lane)
+                {
+                    const auto p = phase[lane] + static_cast<std::uint32_t> (i) * increment[lane];
+                    const auto value = i * laneSize + lane;
+
+                    index[value] = levelOffset[lane] + (p >> shift);
+                    fraction[value] = static_cast<float> (static_cast<std::int32_t> (p & fractionMask)) * fractionScale;
+                }
+            }
+
+            for (int lane = 0; lane < laneSize; ++lane)
+                phase[lane] += static_cast<std::uint32_t> (numThisTime) * increment[lane];
+
+            // 2. Gather both interpolation points.
+            for (int value = 0; value < numThisTimeValues; ++value)
+            {
+                a[value] = table[index[value]];
+                b[value] = table[index[value] + 1];
+            }
+
+            // 3. Interpolate.
+            for (int value = 0; value < numThisTimeValues; ++value)
+                a[value] += fraction[value] * (b[value] - a[value]);
+
+            // 4. Apply each voice's gain and mix the lanes down.
+            for (int i = 0; i < numThisTime; ++i)
+            {
+                auto sum = 0.0f;
+
+                for (int lane = 0; lane < laneSize; ++lane)
+                    sum += a[i * laneSize + lane] * gain[lane];
+
+                output[start + i] += sum;
+            }
+        }
+
+        std::copy_n (phase, laneSize, phases.data() + base);
+    }
+}
+
+} // namespace Audio
+} // namespace StoneyDSP
@@ -0,0 +1,308 @@
+/***************************************************************************//**
+ * @file stoneydsp_wavetable.h
+ * @author Nathan J. Hood <nathanjhood@googlemail.com>
+ * @brief Shared, mipmapped band-limited wavetables and a multi-voice
+ * wavetable oscillator bank.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#define STONEYDSP_WAVETABLE_H_INCLUDED
+
+namespace StoneyDSP
+{
+/** @addtogroup StoneyDSP
+ *  @{
+ */
+
+namespace Audio
+{
+/** @addtogroup Audio
+ *  @{
+ */
+
+/**
+ * @brief An immutable, per-octave band-limited set of single-cycle tables.
+ *
+ * Level ```0``` holds every harmonic below Nyquist of the source cycle; each
+ * following level holds half as many harmonics as the one before it, down to
+ * a pure sine. Every level stores one extra guard sample (a copy of sample
+ * ```0```) so that linear interpolation never needs to wrap.
+ *
+ * Instances are only built by the ```WavetableCache```, are never modified
+ * after construction and are handed out as
+ * ```std::shared_ptr<const WavetableMipMap>```, so one set of tables may be
+ * read concurrently by any number of voices, oscillator banks and plugin
+ * instances.
+ *
+ */
+class WavetableMipMap
+{
+public:
+    /** @brief The smallest supported cycle length. */
+    static constexpr int minTableSize = 8;
+
+    /** @brief The largest supported cycle length. */
+    static constexpr int maxTableSize = 65536;
+
+    /**
+     * @brief Returns true if ```numSamples``` is a power of two between
+     * ```minTableSize``` and ```maxTableSize```.
+     *
+     */
+    static bool isValidTableSize (int numSamples) noexcept;
+
+    /** @brief The number of samples in one cycle of each level. */
+    int getTableSize() const noexcept { return tableSize; }
+
+    /** @brief ```log2 (getTableSize())```. */
+    int getTableOrder() const noexcept { return tableOrder; }
+
+    /** @brief The number of band-limited levels. */
+    int getNumLevels() const noexcept { return numLevels; }
+
+    /** @brief The distance, in samples, between the starts of two levels. */
+    int getLevelStride() const noexcept { return tableSize + 1; }
+
+    /** @brief The content hash used to deduplicate this set of tables. */
+    std::uint64_t getHash() const noexcept { return hash; }
+
+    /**
+     * @brief Returns the ```getTableSize() + 1``` samples of one level.
+     *
+     */
+    const float* getLevel (int level) const noexcept;
+
+    /**
+     * @brief Returns all levels, laid out back-to-back with a stride of
+     * ```getLevelStride()```.
+     *
+     */
+    const float* getData() const noexcept { return tables.data(); }
+
+    /**
+     * @brief Returns the lowest level whose highest harmonic stays below
+     * Nyquist when the table is read at ```cyclesPerSample```.
+     *
+     */
+    int getLevelForIncrement (double cyclesPerSample) const noexcept;
+
+    /**
+     * @brief Returns true if this set of tables was built from exactly this
+     * source cycle.
+     *
+     */
+    bool matches (const float* sourceCycle, int numSamples) const noexcept;
+
+    /**
+     * @brief Hashes a source cycle (64-bit FNV-1a over the sample bits).
+     *
+     */
+    static std::uint64_t computeHash (const float* sourceCycle, int numSamples) noexcept;
+
+private:
+    friend class WavetableCache;
+
+    /**
+     * @brief Builds every mip level from one cycle of ```numSamples```
+     * samples, which must satisfy ```isValidTableSize()```.
+     *
+     */
+    WavetableMipMap (const float* sourceCycle, int numSamples);
+
+    int tableSize, tableOrder, numLevels;
+    std::uint64_t hash;
+    std::vector<float> source, tables;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (WavetableMipMap)
+};
+
+/**
+ * @brief A process-wide, content-addressed store of ```WavetableMipMap```s.
+ *
+ * Access this through a ```juce::SharedResourcePointer<WavetableCache>```;
+ * all holders in the process (every plugin instance loaded by a host) then
+ * share one cache. Identical source cycles resolve to the same tables, which
+ * are built once and freed again when the last user lets go of them.
+ *
+ * Lookups lock, and building new tables allocates and runs FFTs, so call
+ * ```getOrCreate()``` from the message thread or while preparing to play,
+ * never from the audio callback.
+ *
+ */
+class WavetableCache
+{
+public:
+    WavetableCache() = default;
+
+    /**
+     * @brief Returns the shared tables for this source cycle, building them
+     * if no other user currently holds a matching set.
+     *
+     * Returns ```nullptr``` if ```sourceCycle``` is null or ```numSamples```
+     * fails ```WavetableMipMap::isValidTableSize()```.
+     *
+     */
+    std::shared_ptr<const WavetableMipMap> getOrCreate (const float* sourceCycle, int numSamples);
+
+    /**
+     * @brief Samples ```function``` (called with a phase in ```[0, 1)```)
+     * into a cycle of ```tableSize``` samples, then calls
+     * ```getOrCreate()``` with it. Returns ```nullptr``` if ```function```
+     * is empty or ```tableSize``` is invalid.
+     *
+     */
+    std::shared_ptr<const WavetableMipMap> getOrCreate (const std::function<float (double)>& function, int tableSize = 2048);
+
+    /** @brief The number of distinct tables that are currently alive. */
+    int getNumTables() const;
+
+private:
+    void removeExpiredEntries();
+
+    juce::CriticalSection lock;
+    std::unordered_multimap<std::uint64_t, std::weak_ptr<const WavetableMipMap>> entries;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (WavetableCache)
+};
+
+/**
+ * @brief A bank of wavetable oscillator voices reading one shared
+ * ```WavetableMipMap```.
+ *
+ * Voice state is stored as structure-of-arrays and rendered in groups of
+ * ```laneSize``` voices, ```subBlockSize``` samples at a time. Read
+ * positions, the table gather, interpolation and gain are separate passes
+ * over each sub-block, so that phase accumulation, fraction extraction,
+ * interpolation and mixing vectorise across voices; the gather itself stays
+ * a series of scalar loads unless the target has gather instructions.
+ * Phases are 32-bit fixed point and wrap for free.
+ *
+ * ```setWavetable()``` and ```prepare()``` must not be called concurrently
+ * with ```renderNextBlock()```; the voice setters are cheap and intended to
+ * be called from the audio thread between blocks.
+ *
+ */
+class WavetableOscillatorBank
+{
+public:
+    /** @brief The number of voices rendered side by side. */
+    static constexpr int laneSize = 8;
+
+    /** @brief The number of samples rendered per pass. */
+    static constexpr int subBlockSize = 32;
+
+    WavetableOscillatorBank() = default;
+
+    /**
+     * @brief Allocates state for ```maxVoices``` voices (rounded up to a
+     * multiple of ```laneSize```) and silences them all.
+     *
+     */
+    void prepare (double sampleRate, int maxVoices);
+
+    /** @brief Silences every voice and resets their phases. */
+    void reset() noexcept;
+
+    /**
+     * @brief Sets the tables read by every voice. Voice frequencies are
+     * re-evaluated against the new table size.
+     *
+     */
+    void setWavetable (std::shared_ptr<const WavetableMipMap> newTables);
+
+    /**
+     * @brief Returns the tables currently read by this bank.
+     *
+     */
+    const std::shared_ptr<const WavetableMipMap>& getWavetable() const noexcept { return tables; }
+
+    /**
+     * @brief Starts ```voice``` at ```frequencyHz``` and ```gain```, from the
+     * given phase in ```[0, 1)```.
+     *
+     * Negative frequencies play the cycle backwards. At ```0``` Hz the phase
+     * stands still, so a voice with a non-zero gain outputs a constant: its
+     * gain times the table value at its phase. Use ```stopVoice()``` to
+     * silence a voice.
+     *
+     */
+    void startVoice (int voice, float frequencyHz, float gain, float startPhase = 0.0f) noexcept;
+
+    /** @brief Silences ```voice```. */
+    void stopVoice (int voice) noexcept;
+
+    /**
+     * @brief Changes the frequency of ```voice```, keeping its phase. As for
+     * ```startVoice()```, negative frequencies run backwards.
+     *
+     */
+    void setFrequency (int voice, float frequencyHz) noexcept;
+
+    /** @brief Changes the output gain of ```voice```. */
+    void setGain (int voice, float gain) noexcept;
+
+    /** @brief Returns true if ```voice``` has a non-zero gain. */
+    bool isVoiceActive (int voice) const noexcept;
+
+    /** @brief The number of voices this bank was prepared for. */
+    int getNumVoices() const noexcept { return numVoices; }
+
+    /**
+     * @brief Adds the sum of all voices to every channel of
+     * ```outputBuffer```, over ```numSamples``` samples from ```startSample```.
+     *
+     */
+    void renderNextBlock (juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples) noexcept;
+
+    /**
+     * @brief Adds the sum of all voices into ```output```.
+     *
+     */
+    void renderNextBlock (float* output, int numSamples) noexcept;
+
+private:
+    void updateVoice (int voice) noexcept;
+    void updateNumActiveGroups() noexcept;
+
+    std::shared_ptr<const WavetableMipMap> tables;
+
+    double sampleRate = 44100.0;
+    int numVoices = 0, numActiveGroups = 0;
+
+    std::vector<float> frequencies, gains;
+    std::vector<std::uint32_t> phases, increments, levelOffsets;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (WavetableOscillatorBank)
+};
+
+  /// @} group Audio
+} // namespace Audio
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
@@ -34,3 +34,5 @@
 #endif
 
 #include "stoneydsp_audio.h"
+
+#include "oscillators/stoneydsp_wavetable.cpp"
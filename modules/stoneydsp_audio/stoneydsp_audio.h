@@ -42,7 +42,7 @@
   license:            MIT
   minimumCppStandard: 17
 
-  dependencies:       stoneydsp_core
+  dependencies:       stoneydsp_core juce_audio_basics juce_dsp
 
  END_JUCE_MODULE_DECLARATION
 
@@ -52,6 +52,16 @@
 
 #define STONEYDSP_AUDIO_H_INCLUDED
 
+#include <stoneydsp_core/stoneydsp_core.h>
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_dsp/juce_dsp.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
 namespace StoneyDSP
 {
 /**
@@ -63,3 +73,5 @@ namespace Audio
 
 } // namespace Audio
 } // namespace StoneyDSP
+
+#include "oscillators/stoneydsp_wavetable.h"
@@ -34,3 +34,7 @@
 #endif
 
 #include "stoneydsp_graphics.h"
+
+#include "widgets/stoneydsp_layer_cache.cpp"
+#include "widgets/stoneydsp_layered_component.cpp"
+#include "widgets/stoneydsp_filmstrip_knob.cpp"
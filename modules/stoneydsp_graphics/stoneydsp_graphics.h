@@ -42,7 +42,7 @@
   license:            MIT
   minimumCppStandard: 17
 
-  dependencies:       stoneydsp_core
+  dependencies:       stoneydsp_core juce_gui_basics
 
  END_JUCE_MODULE_DECLARATION
 
@@ -52,6 +52,12 @@
 
 #define STONEYDSP_GRAPHICS_H_INCLUDED
 
+#include <stoneydsp_core/stoneydsp_core.h>
+#include <juce_gui_basics/juce_gui_basics.h>
+
+#include <functional>
+#include <typeinfo>
+
 namespace StoneyDSP
 {
 /**
@@ -63,3 +69,7 @@ namespace Graphics
 
 } // namespace Graphics
 } // namespace StoneyDSP
+
+#include "widgets/stoneydsp_layer_cache.h"
+#include "widgets/stoneydsp_layered_component.h"
+#include "widgets/stoneydsp_filmstrip_knob.h"
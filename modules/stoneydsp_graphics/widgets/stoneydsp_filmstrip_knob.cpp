@@ -0,0 +1,165 @@
+/***************************************************************************//**
+ * @file stoneydsp_filmstrip_knob.cpp
+ * @author Nathan J. Hood <nathanjhood@googlemail.com>
+ * @brief A rotary slider drawn from a shared, pre-rendered filmstrip.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+namespace StoneyDSP
+{
+namespace Graphics
+{
+
+FilmstripKnob::FilmstripKnob (const juce::String& newStyleName, int newNumFrames)
+    : juce::Slider (juce::Slider::RotaryHorizontalVerticalDrag, juce::Slider::NoTextBox),
+      styleName (newStyleName),
+      numFrames (juce::jmax (1, newNumFrames))
+{
+}
+
+void FilmstripKnob::setStyleName (const juce::String& newStyleName)
+{
+    if (styleName != newStyleName)
+    {
+        styleName = newStyleName;
+        invalidateFilmstrip();
+    }
+}
+
+void FilmstripKnob::setNumFrames (int newNumFrames)
+{
+    newNumFrames = juce::jmax (1, newNumFrames);
+
+    if (numFrames != newNumFrames)
+    {
+        numFrames = newNumFrames;
+        invalidateFilmstrip();
+    }
+}
+
+void FilmstripKnob::invalidateFilmstrip()
+{
+    filmstrip = {};
+    filmstripKey.clear();
+    repaint();
+}
+
+//==============================================================================
+void FilmstripKnob::paint (juce::Graphics& g)
+{
+    const auto knobBounds = getLookAndFeel().getSliderLayout (*this).sliderBounds;
+    const auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    const auto rotary = getRotaryParameters();
+
+    // Slider has no callback for setRotaryParameters(), so compare them here.
+    if (filmstripKey.isEmpty()
+        || filmstripWidth != knobBounds.getWidth()
+        || filmstripHeight != knobBounds.getHeight()
+        || ! juce::approximatelyEqual (filmstripScale, scale)
+        || ! juce::exactlyEqual (filmstripRotary.startAngleRadians, rotary.startAngleRadians)
+        || ! juce::exactlyEqual (filmstripRotary.endAngleRadians, rotary.endAngleRadians))
+    {
+        filmstripKey = getFilmstripKey();
+        jassert (filmstripKey.isNotEmpty());
+
+        filmstripWidth = knobBounds.getWidth();
+        filmstripHeight = knobBounds.getHeight();
+        filmstripScale = scale;
+        filmstripRotary = rotary;
+
+        const auto lastFrame = (float) juce::jmax (1, numFrames - 1);
+
+        filmstrip = LayerCache::getOrRenderFilmstrip (filmstripKey, filmstripWidth, filmstripHeight, filmstripScale, numFrames,
+                                                      [this, lastFrame] (juce::Graphics& frameGraphics, juce::Rectangle<float> bounds, int frame)
+                                                      {
+                                                          paintFrame (frameGraphics, bounds, (float) frame / lastFrame);
+                                                      });
+    }
+
+    if (filmstrip.isValid())
+    {
+        const auto proportion = juce::jlimit (0.0, 1.0, valueToProportionOfLength (getValue()));
+        const auto frame = juce::roundToInt (proportion * (double) (numFrames - 1));
+        const auto frameHeight = LayerCache::getFrameHeight (filmstrip, numFrames);
+
+        g.drawImage (filmstrip,
+                     knobBounds.getX(), knobBounds.getY(), knobBounds.getWidth(), knobBounds.getHeight(),
+                     0, frame * frameHeight, filmstrip.getWidth(), frameHeight);
+    }
+
+    paintOverlay (g, knobBounds);
+}
+
+void FilmstripKnob::colourChanged()
+{
+    juce::Slider::colourChanged();
+    invalidateFilmstrip();
+}
+
+void FilmstripKnob::lookAndFeelChanged()
+{
+    juce::Slider::lookAndFeelChanged();
+    invalidateFilmstrip();
+}
+
+void FilmstripKnob::enablementChanged()
+{
+    juce::Slider::enablementChanged();
+    invalidateFilmstrip();
+}
+
+//==============================================================================
+juce::String FilmstripKnob::getFilmstripKey() const
+{
+    const auto rotary = getRotaryParameters();
+
+    return "FilmstripKnob:" + styleName
+         + ":" + LayerCache::getLookAndFeelKey (getLookAndFeel())
+         + ":" + juce::String (rotary.startAngleRadians, 4)
+         + ":" + juce::String (rotary.endAngleRadians, 4)
+         + ":" + findColour (juce::Slider::rotarySliderFillColourId).toString()
+         + ":" + findColour (juce::Slider::rotarySliderOutlineColourId).toString()
+         + ":" + findColour (juce::Slider::thumbColourId).toString()
+         + ":" + juce::String (isEnabled() ? 1 : 0);
+}
+
+void FilmstripKnob::paintFrame (juce::Graphics& g, juce::Rectangle<float> bounds, float proportion)
+{
+    const auto rotary = getRotaryParameters();
+    const auto area = bounds.getSmallestIntegerContainer();
+
+    getLookAndFeel().drawRotarySlider (g, area.getX(), area.getY(), area.getWidth(), area.getHeight(),
+                                       proportion, rotary.startAngleRadians, rotary.endAngleRadians, *this);
+}
+
+void FilmstripKnob::paintOverlay (juce::Graphics&, juce::Rectangle<int>)
+{
+}
+
+} // namespace Graphics
+} // namespace StoneyDSP
@@ -0,0 +1,144 @@
+/***************************************************************************//**
+ * @file stoneydsp_filmstrip_knob.h
+ * @author Nathan J. Hood <nathanjhood@googlemail.com>
+ * @brief A rotary slider drawn from a shared, pre-rendered filmstrip.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+
+#define STONEYDSP_FILMSTRIP_KNOB_H_INCLUDED
+
+namespace StoneyDSP
+{
+/** @addtogroup StoneyDSP
+ *  @{
+ */
+
+namespace Graphics
+{
+/** @addtogroup Graphics
+ *  @{
+ */
+
+/**
+ * @brief A rotary ```juce::Slider``` drawn by blitting one frame of a
+ * pre-rendered filmstrip.
+ *
+ * The filmstrip is rendered through ```LayerCache``` once per knob size,
+ * display scale and ```getFilmstripKey()```, so every knob sharing a style
+ * and size shares one image and value changes never touch vector paths.
+ *
+ * By default each frame is drawn with the LookAndFeel's
+ * ```drawRotarySlider()```, and the key covers the style name, the
+ * LookAndFeel, rotary parameters, rotary colours and enablement. It does not
+ * cover hover state: frames are rendered once for every pointer state, so a
+ * LookAndFeel that highlights on ```isMouseOverOrDragging()``` (such as
+ * ```juce::LookAndFeel_V2```) shows whichever state was current when the
+ * filmstrip was rendered. Override ```getFilmstripKey()``` and
+ * ```paintFrame()``` together for custom artwork, and ```paintOverlay()```
+ * for anything that must follow live state (modulation rings, hover
+ * highlights...).
+ *
+ */
+class FilmstripKnob : public juce::Slider
+{
+public:
+    /**
+     * @brief Creates a knob with no text box, drawing ```numFrames```
+     * positions. Knobs with the same ```styleName```, LookAndFeel, colours
+     * and size share images.
+     *
+     */
+    explicit FilmstripKnob (const juce::String& styleName = "rotary", int numFrames = 128);
+
+    //==============================================================================
+    /** @brief Sets the name that identifies this knob's artwork. */
+    void setStyleName (const juce::String& newStyleName);
+
+    /** @brief Returns the name that identifies this knob's artwork. */
+    const juce::String& getStyleName() const noexcept { return styleName; }
+
+    /** @brief Sets how many distinct positions the filmstrip holds. */
+    void setNumFrames (int newNumFrames);
+
+    /** @brief Returns how many distinct positions the filmstrip holds. */
+    int getNumFrames() const noexcept { return numFrames; }
+
+    /** @brief Drops the current filmstrip and repaints the knob. */
+    void invalidateFilmstrip();
+
+    //==============================================================================
+    /** @internal */
+    void paint (juce::Graphics&) override;
+    /** @internal */
+    void colourChanged() override;
+    /** @internal */
+    void lookAndFeelChanged() override;
+    /** @internal */
+    void enablementChanged() override;
+
+protected:
+    /**
+     * @brief Describes the artwork drawn by ```paintFrame()```. Knobs
+     * returning equal keys at the same size must draw identical frames, so
+     * overrides must cover everything their ```paintFrame()``` reads
+     * (including ```LayerCache::getLookAndFeelKey()``` if it draws through
+     * the LookAndFeel).
+     *
+     */
+    virtual juce::String getFilmstripKey() const;
+
+    /**
+     * @brief Draws the knob at ```proportion``` (```0``` to ```1```) of its
+     * travel into ```bounds``` (logical pixels).
+     *
+     */
+    virtual void paintFrame (juce::Graphics&, juce::Rectangle<float> bounds, float proportion);
+
+    /** @brief Draws the live overlay on top of the current frame. */
+    virtual void paintOverlay (juce::Graphics&, juce::Rectangle<int> knobBounds);
+
+private:
+    juce::String styleName;
+    int numFrames;
+
+    juce::Image filmstrip;
+    juce::String filmstripKey;
+    juce::Slider::RotaryParameters filmstripRotary {};
+    int filmstripWidth = 0, filmstripHeight = 0;
+    float filmstripScale = 0.0f;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (FilmstripKnob)
+};
+
+  /// @} group Graphics
+} // namespace Graphics
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
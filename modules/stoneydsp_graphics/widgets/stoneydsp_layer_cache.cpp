@@ -0,0 +1,111 @@
+/***************************************************************************//**
+ * @file stoneydsp_layer_cache.cpp
+ * @author Nathan J. Hood <nathanjhood@googlemail.com>
+ * @brief A shared cache of pre-rendered widget layers and filmstrips.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+namespace StoneyDSP
+{
+namespace Graphics
+{
+
+juce::Image LayerCache::getOrRender (const juce::String& key, int width, int height, float scale,
+                                     const std::function<void (juce::Graphics&, juce::Rectangle<float>)>& renderer)
+{
+    return getOrRenderFilmstrip (key, width, height, scale, 1,
+                                 [&renderer] (juce::Graphics& g, juce::Rectangle<float> bounds, int)
+                                 {
+                                     renderer (g, bounds);
+                                 });
+}
+
+juce::Image LayerCache::getOrRenderFilmstrip (const juce::String& key, int width, int height, float scale,
+                                              int numFrames, const FrameRenderer& renderer)
+{
+    JUCE_ASSERT_MESSAGE_MANAGER_IS_LOCKED
+
+    jassert (numFrames > 0);
+
+    if (width <= 0 || height <= 0 || numFrames <= 0 || scale <= 0.0f)
+        return {};
+
+    const auto hash = getHash (key, width, height, scale, numFrames);
+
+    auto image = juce::ImageCache::getFromHashCode (hash);
+
+    if (image.isValid())
+        return image;
+
+    const auto frameWidth  = juce::jmax (1, juce::roundToInt ((float) width  * scale));
+    const auto frameHeight = juce::jmax (1, juce::roundToInt ((float) height * scale));
+
+    image = juce::Image (juce::Image::ARGB, frameWidth, frameHeight * numFrames, true);
+
+    {
+        juce::Graphics g (image);
+
+        const auto transform = juce::AffineTransform::scale ((float) frameWidth  / (float) width,
+                                                             (float) frameHeight / (float) height);
+
+        for (int frame = 0; frame < numFrames; ++frame)
+        {
+            const juce::Graphics::ScopedSaveState state (g);
+
+            g.reduceClipRegion (0, frame * frameHeight, frameWidth, frameHeight);
+            g.addTransform (transform.translated (0.0f, (float) (frame * frameHeight)));
+
+            renderer (g, { 0.0f, 0.0f, (float) width, (float) height }, frame);
+        }
+    }
+
+    juce::ImageCache::addImageToCache (image, hash);
+    return image;
+}
+
+int LayerCache::getFrameHeight (const juce::Image& filmstrip, int numFrames) noexcept
+{
+    return numFrames > 0 ? filmstrip.getHeight() / numFrames : 0;
+}
+
+juce::int64 LayerCache::getHash (const juce::String& key, int width, int height, float scale, int numFrames)
+{
+    return (key
+            + "|" + juce::String (width) + "x" + juce::String (height)
+            + "@" + juce::String (scale, 3)
+            + "#" + juce::String (numFrames)).hashCode64();
+}
+
+juce::String LayerCache::getLookAndFeelKey (const juce::LookAndFeel& lookAndFeel)
+{
+    // The type guards against a new LookAndFeel reusing a deleted one's address.
+    return juce::String (typeid (lookAndFeel).name())
+         + "@" + juce::String::toHexString ((juce::pointer_sized_int) &lookAndFeel);
+}
+
+} // namespace Graphics
+} // namespace StoneyDSP
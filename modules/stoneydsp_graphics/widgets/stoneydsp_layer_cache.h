@@ -0,0 +1,119 @@
+/***************************************************************************//**
+ * @file stoneydsp_layer_cache.h
+ * @author Nathan J. Hood <nathanjhood@googlemail.com>
+ * @brief A shared cache of pre-rendered widget layers and filmstrips.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#define STONEYDSP_LAYER_CACHE_H_INCLUDED
+
+namespace StoneyDSP
+{
+/** @addtogroup StoneyDSP
+ *  @{
+ */
+
+namespace Graphics
+{
+/** @addtogroup Graphics
+ *  @{
+ */
+
+/**
+ * @brief Rasterises static widget artwork once per size and scale factor,
+ * and shares the result through ```juce::ImageCache```.
+ *
+ * Each image is identified by a caller-supplied key that describes what is
+ * drawn (style name, colours, ranges...), plus its logical size, display
+ * scale and frame count. Widgets that draw the same thing at the same size
+ * therefore share one image, across every editor in the process.
+ *
+ * Images stay cached while any widget still holds them, and for
+ * ```juce::ImageCache```'s timeout after that. Call from the message thread,
+ * or from any thread holding the ```juce::MessageManagerLock``` (as
+ * ```paint()``` does when a ```juce::OpenGLContext``` is attached).
+ *
+ */
+class LayerCache
+{
+public:
+    /**
+     * @brief Paints one frame into ```bounds```, given in logical
+     * (unscaled) coordinates.
+     *
+     */
+    using FrameRenderer = std::function<void (juce::Graphics&, juce::Rectangle<float> bounds, int frameIndex)>;
+
+    /**
+     * @brief Returns the cached single-frame image for ```key```, rendering it
+     * first if needed. The image is ```width``` by ```height``` logical
+     * pixels at ```scale``` physical pixels per logical pixel.
+     *
+     */
+    static juce::Image getOrRender (const juce::String& key, int width, int height, float scale,
+                                    const std::function<void (juce::Graphics&, juce::Rectangle<float>)>& renderer);
+
+    /**
+     * @brief Returns the cached vertical filmstrip for ```key```, rendering
+     * it first if needed. Frame ```i``` occupies physical rows
+     * ```[i * getFrameHeight(), (i + 1) * getFrameHeight())```.
+     *
+     */
+    static juce::Image getOrRenderFilmstrip (const juce::String& key, int width, int height, float scale,
+                                             int numFrames, const FrameRenderer& renderer);
+
+    /**
+     * @brief The physical height of one frame in an image returned by
+     * ```getOrRenderFilmstrip()```.
+     *
+     */
+    static int getFrameHeight (const juce::Image& filmstrip, int numFrames) noexcept;
+
+    /**
+     * @brief The hash under which an image with these properties is cached.
+     *
+     */
+    static juce::int64 getHash (const juce::String& key, int width, int height, float scale, int numFrames);
+
+    /**
+     * @brief Identifies a LookAndFeel instance, by dynamic type and address,
+     * for use in keys of artwork drawn through it.
+     *
+     */
+    static juce::String getLookAndFeelKey (const juce::LookAndFeel& lookAndFeel);
+
+private:
+    LayerCache() = delete;
+};
+
+  /// @} group Graphics
+} // namespace Graphics
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
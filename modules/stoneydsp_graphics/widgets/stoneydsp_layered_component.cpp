@@ -0,0 +1,92 @@
+/***************************************************************************//**
+ * @file stoneydsp_layered_component.cpp
+ * @author Nathan J. Hood <nathanjhood@googlemail.com>
+ * @brief A component that caches its static layer as a shared image.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+namespace StoneyDSP
+{
+namespace Graphics
+{
+
+void LayeredComponent::paint (juce::Graphics& g)
+{
+    const auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+
+    if (staticLayerKey.isEmpty()
+        || staticLayerWidth != getWidth()
+        || staticLayerHeight != getHeight()
+        || ! juce::approximatelyEqual (staticLayerScale, scale))
+    {
+        const auto key = getStaticLayerKey();
+        jassert (key.isNotEmpty());
+
+        staticLayerKey = key + "|" + LayerCache::getLookAndFeelKey (getLookAndFeel());
+
+        staticLayerWidth = getWidth();
+        staticLayerHeight = getHeight();
+        staticLayerScale = scale;
+
+        staticLayer = LayerCache::getOrRender (staticLayerKey, staticLayerWidth, staticLayerHeight, staticLayerScale,
+                                               [this] (juce::Graphics& layerGraphics, juce::Rectangle<float> bounds)
+                                               {
+                                                   paintStaticLayer (layerGraphics, bounds);
+                                               });
+    }
+
+    if (staticLayer.isValid())
+        g.drawImage (staticLayer, getLocalBounds().toFloat());
+
+    paintDynamicLayer (g);
+}
+
+void LayeredComponent::colourChanged()
+{
+    invalidateStaticLayer();
+}
+
+void LayeredComponent::lookAndFeelChanged()
+{
+    invalidateStaticLayer();
+}
+
+void LayeredComponent::invalidateStaticLayer()
+{
+    staticLayer = {};
+    staticLayerKey.clear();
+    repaint();
+}
+
+void LayeredComponent::repaintDynamicLayer()
+{
+    repaint (getDynamicLayerBounds());
+}
+
+} // namespace Graphics
+} // namespace StoneyDSP
@@ -0,0 +1,114 @@
+/***************************************************************************//**
+ * @file stoneydsp_layered_component.h
+ * @author Nathan J. Hood <nathanjhood@googlemail.com>
+ * @brief A component that caches its static layer as a shared image.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+
+#define STONEYDSP_LAYERED_COMPONENT_H_INCLUDED
+
+namespace StoneyDSP
+{
+/** @addtogroup StoneyDSP
+ *  @{
+ */
+
+namespace Graphics
+{
+/** @addtogroup Graphics
+ *  @{
+ */
+
+/**
+ * @brief A component split into a cached static layer and a live dynamic
+ * layer.
+ *
+ * Subclasses draw everything that does not depend on their current state
+ * (backgrounds, scales, labels) in ```paintStaticLayer()```. That layer is
+ * rasterised through ```LayerCache``` once per size and display scale, and
+ * shared by every component returning the same ```getStaticLayerKey()```
+ * under the same LookAndFeel. ```paintDynamicLayer()``` draws the overlay on
+ * top of it every time the component is painted.
+ *
+ * On a state change, call ```repaintDynamicLayer()``` rather than
+ * ```repaint()``` so that only the overlay's bounds are redrawn. Call
+ * ```invalidateStaticLayer()``` if anything the key describes has changed.
+ *
+ */
+class LayeredComponent : public juce::Component
+{
+public:
+    LayeredComponent() = default;
+
+    //==============================================================================
+    void paint (juce::Graphics&) override;
+    void colourChanged() override;
+    void lookAndFeelChanged() override;
+
+    //==============================================================================
+    /** @brief Drops the current static layer and repaints the component. */
+    void invalidateStaticLayer();
+
+    /** @brief Repaints only ```getDynamicLayerBounds()```. */
+    void repaintDynamicLayer();
+
+protected:
+    /**
+     * @brief Describes the contents of the static layer. Components returning
+     * equal keys at the same size must paint identical static layers, so the
+     * key must cover every colour and setting ```paintStaticLayer()``` reads.
+     * The LookAndFeel is already accounted for by this class.
+     *
+     */
+    virtual juce::String getStaticLayerKey() const = 0;
+
+    /** @brief Paints the static layer into ```bounds``` (logical pixels). */
+    virtual void paintStaticLayer (juce::Graphics&, juce::Rectangle<float> bounds) = 0;
+
+    /** @brief Paints the state-dependent overlay. */
+    virtual void paintDynamicLayer (juce::Graphics&) {}
+
+    /** @brief The area repainted by ```repaintDynamicLayer()```. */
+    virtual juce::Rectangle<int> getDynamicLayerBounds() const { return getLocalBounds(); }
+
+private:
+    juce::Image staticLayer;
+    juce::String staticLayerKey;
+    int staticLayerWidth = 0, staticLayerHeight = 0;
+    float staticLayerScale = 0.0f;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LayeredComponent)
+};
+
+  /// @} group Graphics
+} // namespace Graphics
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
@@ -0,0 +1,151 @@
+/***************************************************************************//**
+ * @file harness.h
+ * @author Nathan J. Hood <nathanjhood@googlemail.com>
+ * @brief Null-test, golden-render and throughput helpers for the StoneyDSP tests.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <stoneydsp_audio/stoneydsp_audio.h>
+#include <juce_audio_formats/juce_audio_formats.h>
+
+#include <functional>
+
+namespace StoneyDSP
+{
+/**
+ * @brief The ```StoneyDSP::Tests``` namespace.
+ *
+ */
+namespace Tests
+{
+
+/**
+ * @brief Command-line settings shared by every test in the run.
+ *
+ */
+struct Options
+{
+    /** @brief Where golden renders are read from and recorded to. */
+    juce::File goldenDirectory;
+
+    /** @brief The JSON file holding recorded throughput baselines. */
+    juce::File baselineFile;
+
+    /** @brief The fraction below baseline that throughput may drop. */
+    double throughputTolerance = 0.25;
+
+    /** @brief Record new goldens and baselines instead of comparing. */
+    bool record = false;
+
+    static Options& get();
+};
+
+/**
+ * @brief The difference between two renders.
+ *
+ */
+struct NullResult
+{
+    double maxAbsoluteError = 0.0;
+    double rmsError = 0.0;
+
+    /** @brief ```maxAbsoluteError``` in dBFS. */
+    double getMaxErrorDecibels() const;
+
+    /**
+     * @brief Compares every sample of two buffers of equal shape.
+     *
+     */
+    static NullResult compare (const juce::AudioBuffer<float>& actual, const juce::AudioBuffer<float>& expected);
+};
+
+/**
+ * @brief A ```juce::UnitTest``` with null-test, golden-render and
+ * throughput checks.
+ *
+ * Checks that have nothing recorded to compare against are reported as
+ * skipped. A run in which any check was skipped exits with ```77```, which
+ * ctest reports as a skipped test, even if other checks passed.
+ *
+ */
+class RegressionTest : public juce::UnitTest
+{
+public:
+    RegressionTest (const juce::String& testName, const juce::String& testCategory);
+
+    /** @brief The number of checks that compared something this run. */
+    static int getNumChecked() noexcept;
+
+    /** @brief The number of checks skipped this run. */
+    static int getNumSkipped() noexcept;
+
+protected:
+    /** @brief Logs ```reason``` and counts a skipped check. */
+    void skip (const juce::String& reason);
+
+    /**
+     * @brief Expects ```actual``` to null against ```expected``` to within
+     * ```maxErrorDecibels``` dBFS.
+     *
+     */
+    void expectNull (const juce::AudioBuffer<float>& actual, const juce::AudioBuffer<float>& expected,
+                     double maxErrorDecibels, const juce::String& what);
+
+    /**
+     * @brief Expects ```actual``` to null against the golden render named
+     * ```goldenName``` to within ```maxErrorDecibels``` dBFS, or records it
+     * when running with ```--record```.
+     *
+     */
+    void expectMatchesGolden (const juce::String& goldenName, const juce::AudioBuffer<float>& actual,
+                              double sampleRate, double maxErrorDecibels);
+
+    /**
+     * @brief Expects ```samplesPerSecond``` to be no more than
+     * ```Options::throughputTolerance``` below the baseline recorded under
+     * ```baselineName```, or records it when running with ```--record```.
+     *
+     * Always skipped in debug builds, where timings mean nothing.
+     *
+     */
+    void expectThroughput (const juce::String& baselineName, double samplesPerSecond);
+
+    /**
+     * @brief Times ```numBlocks``` calls to ```renderBlock``` over
+     * ```numRuns``` runs, after one untimed warm-up run, and returns the
+     * best rate in samples per second.
+     *
+     */
+    static double measureThroughput (const std::function<void()>& renderBlock, int samplesPerBlock,
+                                     int numBlocks, int numRuns = 5);
+};
+
+} // namespace Tests
+} // namespace StoneyDSP
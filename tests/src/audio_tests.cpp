@@ -0,0 +1,278 @@
+/***************************************************************************//**
+ * @file audio_tests.cpp
+ * @author Nathan J. Hood <nathanjhood@googlemail.com>
+ * @brief Regression tests for the stoneydsp_audio module.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+#include "StoneyDSPTests/harness.h"
+
+namespace StoneyDSP
+{
+namespace Tests
+{
+
+namespace
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int blockSize = 512;
+    constexpr int tableSize = 2048;
+
+    float saw (double phase)
+    {
+        return (float) (2.0 * phase - 1.0);
+    }
+
+    /** The 1st, 3rd and 5th harmonics. Only levels holding 8 or more harmonics
+        reproduce it exactly: levels 0 to 7 of a 2048 sample table, which play
+        up to 3 kHz at 48 kHz. */
+    double threeHarmonics (double phase)
+    {
+        const auto w = juce::MathConstants<double>::twoPi * phase;
+        return std::sin (w) + 0.5 * std::sin (3.0 * w) + 0.25 * std::sin (5.0 * w);
+    }
+
+    void renderInBlocks (Audio::WavetableOscillatorBank& bank, juce::AudioBuffer<float>& buffer,
+                         const std::function<void (int startSample)>& beforeBlock = {})
+    {
+        buffer.clear();
+
+        for (int start = 0; start < buffer.getNumSamples(); start += blockSize)
+        {
+            if (beforeBlock)
+                beforeBlock (start);
+
+            bank.renderNextBlock (buffer, start, juce::jmin (blockSize, buffer.getNumSamples() - start));
+        }
+    }
+} // namespace
+
+//==============================================================================
+class WavetableNullTests final : public RegressionTest
+{
+public:
+    WavetableNullTests() : RegressionTest ("WavetableOscillatorBank", "StoneyDSP Null") {}
+
+    void runTest() override
+    {
+        juce::SharedResourcePointer<Audio::WavetableCache> cache;
+
+        beginTest ("Voices null against an analytic render");
+        {
+            const float frequencies[] = { 110.0f, 440.0f, 1760.0f };
+            const float gains[]       = { 0.5f, 0.25f, 0.125f };
+            const float phases[]      = { 0.0f, 0.25f, 0.6f };
+
+            Audio::WavetableOscillatorBank bank;
+            bank.prepare (sampleRate, 3);
+            bank.setWavetable (cache->getOrCreate ([] (double p) { return (float) threeHarmonics (p); }, tableSize));
+
+            for (int voice = 0; voice < 3; ++voice)
+                bank.startVoice (voice, frequencies[voice], gains[voice], phases[voice]);
+
+            juce::AudioBuffer<float> actual (1, 8192), expected (1, 8192);
+            renderInBlocks (bank, actual);
+
+            for (int i = 0; i < expected.getNumSamples(); ++i)
+            {
+                double sum = 0.0;
+
+                for (int voice = 0; voice < 3; ++voice)
+                {
+                    const auto phase = (double) phases[voice] + (double) frequencies[voice] * (double) i / sampleRate;
+                    sum += (double) gains[voice] * threeHarmonics (phase - std::floor (phase));
+                }
+
+                expected.setSample (0, i, (float) sum);
+            }
+
+            // Fixed-point phase steps and linear interpolation of a 2048
+            // sample table put the error floor well below -90 dBFS.
+            expectNull (actual, expected, -80.0, "WavetableOscillatorBank vs analytic");
+        }
+
+        beginTest ("Negative frequencies run backwards");
+        {
+            constexpr float frequency = -440.0f;
+            constexpr float phase = 0.3f;
+
+            Audio::WavetableOscillatorBank bank;
+            bank.prepare (sampleRate, 1);
+            bank.setWavetable (cache->getOrCreate ([] (double p) { return (float) threeHarmonics (p); }, tableSize));
+            bank.startVoice (0, frequency, 0.5f, phase);
+
+            juce::AudioBuffer<float> actual (1, 8192), expected (1, 8192);
+            renderInBlocks (bank, actual);
+
+            for (int i = 0; i < expected.getNumSamples(); ++i)
+            {
+                const auto p = (double) phase + (double) frequency * (double) i / sampleRate;
+                expected.setSample (0, i, (float) (0.5 * threeHarmonics (p - std::floor (p))));
+            }
+
+            expectNull (actual, expected, -80.0, "WavetableOscillatorBank at -440 Hz vs analytic");
+        }
+
+        beginTest ("Identical cycles share one set of tables");
+        {
+            std::vector<float> cycle ((size_t) tableSize);
+
+            for (int i = 0; i < tableSize; ++i)
+                cycle[(size_t) i] = saw ((double) i / (double) tableSize);
+
+            const auto a = cache->getOrCreate (saw, tableSize);
+            const auto b = cache->getOrCreate (cycle.data(), tableSize);
+
+            cycle[1] += 1.0e-3f;
+            const auto c = cache->getOrCreate (cycle.data(), tableSize);
+
+            expect (a == b, "Identical cycles were built twice");
+            expect (a != c, "Different cycles were shared");
+        }
+
+        beginTest ("Invalid table sizes are rejected");
+        {
+            std::vector<float> cycle (100, 0.0f);
+
+            expect (cache->getOrCreate (cycle.data(), 100) == nullptr, "A 100 sample cycle was accepted");
+            expect (cache->getOrCreate (saw, 100) == nullptr, "A 100 sample table was accepted");
+            expect (cache->getOrCreate (saw, 2 * Audio::WavetableMipMap::maxTableSize) == nullptr, "An oversized table was accepted");
+            expect (cache->getOrCreate (nullptr, tableSize) == nullptr, "A null cycle was accepted");
+        }
+
+        beginTest ("Every level stays below Nyquist");
+        {
+            const auto tables = cache->getOrCreate (saw, tableSize);
+            juce::dsp::FFT fft (tables->getTableOrder());
+            std::vector<float> spectrum ((size_t) (2 * tableSize));
+
+            for (auto frequency = 20.0; frequency < sampleRate / 2.0; frequency *= 1.1)
+            {
+                const auto level = tables->getLevelForIncrement (frequency / sampleRate);
+                const auto* data = tables->getLevel (level);
+
+                std::fill (spectrum.begin(), spectrum.end(), 0.0f);
+                std::copy (data, data + tableSize, spectrum.begin());
+                fft.performFrequencyOnlyForwardTransform (spectrum.data());
+
+                // Energy in any harmonic that would fold back at this pitch.
+                const auto firstAliasing = (int) std::floor (sampleRate / (2.0 * frequency)) + 1;
+                auto aliased = 0.0f;
+
+                for (int bin = firstAliasing; bin <= tableSize / 2; ++bin)
+                    aliased = juce::jmax (aliased, spectrum[(size_t) bin] / (float) (tableSize / 2));
+
+                expect (juce::Decibels::gainToDecibels (aliased) < -90.0f,
+                        "Level " + juce::String (level) + " aliases at " + juce::String (frequency, 1) + " Hz");
+            }
+        }
+    }
+};
+
+static WavetableNullTests wavetableNullTests;
+
+//==============================================================================
+class WavetableGoldenTests final : public RegressionTest
+{
+public:
+    WavetableGoldenTests() : RegressionTest ("WavetableOscillatorBank", "StoneyDSP Golden") {}
+
+    void runTest() override
+    {
+        juce::SharedResourcePointer<Audio::WavetableCache> cache;
+
+        beginTest ("Sixteen saw voices with a pitch change");
+        {
+            constexpr int numVoices = 16;
+
+            Audio::WavetableOscillatorBank bank;
+            bank.prepare (sampleRate, numVoices);
+            bank.setWavetable (cache->getOrCreate (saw, tableSize));
+
+            for (int voice = 0; voice < numVoices; ++voice)
+                bank.startVoice (voice, 55.0f * std::pow (2.0f, (float) voice / 3.0f), 1.0f / numVoices, (float) voice / numVoices);
+
+            juce::AudioBuffer<float> actual (1, (int) sampleRate / 2);
+
+            // Halfway through, sweep every voice up two octaves so the render
+            // also covers switching mip levels mid-note.
+            renderInBlocks (bank, actual, [&] (int start)
+            {
+                if (start == blockSize * 24)
+                    for (int voice = 0; voice < numVoices; ++voice)
+                        bank.setFrequency (voice, 220.0f * std::pow (2.0f, (float) voice / 3.0f));
+            });
+
+            // FFT back ends differ slightly between platforms, so allow a
+            // little more than float rounding.
+            expectMatchesGolden ("wavetable_oscillator_bank_saw", actual, sampleRate, -100.0);
+        }
+    }
+};
+
+static WavetableGoldenTests wavetableGoldenTests;
+
+//==============================================================================
+class WavetableThroughputTests final : public RegressionTest
+{
+public:
+    WavetableThroughputTests() : RegressionTest ("WavetableOscillatorBank", "StoneyDSP Throughput") {}
+
+    void runTest() override
+    {
+        juce::SharedResourcePointer<Audio::WavetableCache> cache;
+
+        beginTest ("64 voices");
+        {
+            constexpr int numVoices = 64;
+
+            Audio::WavetableOscillatorBank bank;
+            bank.prepare (sampleRate, numVoices);
+            bank.setWavetable (cache->getOrCreate (saw, tableSize));
+
+            for (int voice = 0; voice < numVoices; ++voice)
+                bank.startVoice (voice, 30.0f * std::pow (2.0f, (float) voice / 8.0f), 1.0f / numVoices);
+
+            juce::AudioBuffer<float> buffer (2, blockSize);
+
+            // Rated in voice-samples per second.
+            const auto samplesPerSecond = measureThroughput ([&]
+            {
+                buffer.clear();
+                bank.renderNextBlock (buffer, 0, blockSize);
+            }, blockSize * numVoices, 400);
+
+            expectThroughput ("WavetableOscillatorBank.64Voices", samplesPerSecond);
+        }
+    }
+};
+
+static WavetableThroughputTests wavetableThroughputTests;
+
+} // namespace Tests
+} // namespace StoneyDSP
@@ -0,0 +1,209 @@
+/***************************************************************************//**
+ * @file graphics_tests.cpp
+ * @author Nathan J. Hood <nathanjhood@googlemail.com>
+ * @brief Tests for the stoneydsp_graphics module.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+
+#include <stoneydsp_graphics/stoneydsp_graphics.h>
+
+namespace StoneyDSP
+{
+namespace Tests
+{
+
+namespace
+{
+    juce::Image snapshot (juce::Component& component)
+    {
+        return component.createComponentSnapshot (component.getLocalBounds(), true, 1.0f);
+    }
+
+    bool haveSamePixels (const juce::Image& a, const juce::Image& b)
+    {
+        if (a.getBounds() != b.getBounds())
+            return false;
+
+        for (int y = 0; y < a.getHeight(); ++y)
+            for (int x = 0; x < a.getWidth(); ++x)
+                if (a.getPixelAt (x, y) != b.getPixelAt (x, y))
+                    return false;
+
+        return true;
+    }
+
+    class CountingKnob final : public Graphics::FilmstripKnob
+    {
+    public:
+        using FilmstripKnob::FilmstripKnob;
+
+        int numFramesPainted = 0;
+
+    protected:
+        void paintFrame (juce::Graphics& g, juce::Rectangle<float> bounds, float proportion) override
+        {
+            ++numFramesPainted;
+            FilmstripKnob::paintFrame (g, bounds, proportion);
+        }
+    };
+
+    class CountingPanel final : public Graphics::LayeredComponent
+    {
+    public:
+        int numStaticLayersPainted = 0;
+
+    protected:
+        juce::String getStaticLayerKey() const override
+        {
+            return "StoneyDSP Graphics test panel:" + findColour (juce::ResizableWindow::backgroundColourId).toString();
+        }
+
+        void paintStaticLayer (juce::Graphics& g, juce::Rectangle<float> bounds) override
+        {
+            ++numStaticLayersPainted;
+            g.setColour (findColour (juce::ResizableWindow::backgroundColourId));
+            g.fillEllipse (bounds);
+        }
+    };
+} // namespace
+
+//==============================================================================
+class GraphicsTests final : public juce::UnitTest
+{
+public:
+    GraphicsTests() : juce::UnitTest ("LayerCache", "StoneyDSP Graphics") {}
+
+    void runTest() override
+    {
+        const juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+        beginTest ("Filmstrips are shared by key, size and scale");
+        {
+            int numFramesPainted = 0;
+
+            const auto render = [&numFramesPainted] (const juce::String& key, float scale, int numFrames)
+            {
+                return Graphics::LayerCache::getOrRenderFilmstrip (key, 40, 30, scale, numFrames,
+                                                                   [&numFramesPainted] (juce::Graphics& g, juce::Rectangle<float> bounds, int)
+                                                                   {
+                                                                       ++numFramesPainted;
+                                                                       g.fillRect (bounds);
+                                                                   });
+            };
+
+            const auto a = render ("StoneyDSP Graphics test filmstrip", 1.0f, 8);
+            const auto b = render ("StoneyDSP Graphics test filmstrip", 1.0f, 8);
+
+            expect (a.isValid() && a == b, "The same key, size and scale rendered a new image");
+            expectEquals (numFramesPainted, 8);
+
+            const auto scaled = render ("StoneyDSP Graphics test filmstrip", 2.0f, 8);
+
+            expect (scaled != a, "A new scale reused the old image");
+            expectEquals (scaled.getWidth(), 80);
+            expectEquals (numFramesPainted, 16);
+
+            const auto moreFrames = render ("StoneyDSP Graphics test filmstrip", 1.0f, 12);
+
+            expect (moreFrames != a, "A new frame count reused the old image");
+            expectEquals (numFramesPainted, 28);
+
+            for (const auto& [image, numFrames] : { std::make_pair (a, 8), std::make_pair (scaled, 8), std::make_pair (moreFrames, 12) })
+                expectEquals (Graphics::LayerCache::getFrameHeight (image, numFrames) * numFrames, image.getHeight());
+        }
+
+        beginTest ("FilmstripKnob re-renders when its artwork changes");
+        {
+            juce::LookAndFeel_V4 light (juce::LookAndFeel_V4::getLightColourScheme());
+
+            CountingKnob knob ("StoneyDSP Graphics test knob", 16);
+            knob.setBounds (0, 0, 64, 64);
+
+            // Half way, so that the fill arc and the thumb are both drawn.
+            knob.setRange (0.0, 1.0);
+            knob.setValue (0.5, juce::dontSendNotification);
+
+            const auto first = snapshot (knob);
+            expectEquals (knob.numFramesPainted, 16);
+
+            const auto again = snapshot (knob);
+            expectEquals (knob.numFramesPainted, 16, "An unchanged knob rendered its filmstrip again");
+            expect (haveSamePixels (first, again));
+
+            knob.setColour (juce::Slider::rotarySliderFillColourId, juce::Colours::red);
+            const auto recoloured = snapshot (knob);
+            expectEquals (knob.numFramesPainted, 32, "setColour() kept the old filmstrip");
+            expect (! haveSamePixels (again, recoloured), "setColour() did not change the knob's pixels");
+
+            knob.setLookAndFeel (&light);
+            const auto relooked = snapshot (knob);
+            expectEquals (knob.numFramesPainted, 48, "setLookAndFeel() kept the old filmstrip");
+            expect (! haveSamePixels (recoloured, relooked), "setLookAndFeel() did not change the knob's pixels");
+
+            knob.setRotaryParameters (0.0f, juce::MathConstants<float>::pi, true);
+            const auto rerotated = snapshot (knob);
+            expectEquals (knob.numFramesPainted, 64, "setRotaryParameters() kept the old filmstrip");
+            expect (! haveSamePixels (relooked, rerotated), "setRotaryParameters() did not change the knob's pixels");
+
+            knob.setLookAndFeel (nullptr);
+        }
+
+        beginTest ("LayeredComponent re-renders when its artwork changes");
+        {
+            juce::LookAndFeel_V4 light (juce::LookAndFeel_V4::getLightColourScheme());
+
+            CountingPanel panel;
+            panel.setBounds (0, 0, 48, 32);
+
+            const auto first = snapshot (panel);
+            expectEquals (panel.numStaticLayersPainted, 1);
+
+            snapshot (panel);
+            expectEquals (panel.numStaticLayersPainted, 1, "An unchanged panel rendered its static layer again");
+
+            panel.setColour (juce::ResizableWindow::backgroundColourId, juce::Colours::red);
+            const auto recoloured = snapshot (panel);
+            expectEquals (panel.numStaticLayersPainted, 2, "setColour() kept the old static layer");
+            expect (! haveSamePixels (first, recoloured), "setColour() did not change the panel's pixels");
+
+            panel.removeColour (juce::ResizableWindow::backgroundColourId);
+            panel.setLookAndFeel (&light);
+            const auto relooked = snapshot (panel);
+            expectEquals (panel.numStaticLayersPainted, 3, "setLookAndFeel() kept the old static layer");
+            expect (! haveSamePixels (first, relooked), "setLookAndFeel() did not change the panel's pixels");
+
+            panel.setLookAndFeel (nullptr);
+        }
+    }
+};
+
+static GraphicsTests graphicsTests;
+
+} // namespace Tests
+} // namespace StoneyDSP
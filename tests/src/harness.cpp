@@ -0,0 +1,263 @@
+/***************************************************************************//**
+ * @file harness.cpp
+ * @author Nathan J. Hood <nathanjhood@googlemail.com>
+ * @brief Null-test, golden-render and throughput helpers for the StoneyDSP tests.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+#include "StoneyDSPTests/harness.h"
+
+namespace StoneyDSP
+{
+namespace Tests
+{
+
+namespace
+{
+    int numChecked = 0;
+    int numSkipped = 0;
+
+    bool writeWav (const juce::File& file, const juce::AudioBuffer<float>& buffer, double sampleRate)
+    {
+        if (file.getParentDirectory().createDirectory().failed() || ! file.deleteFile())
+            return false;
+
+        auto stream = std::make_unique<juce::FileOutputStream> (file);
+
+        if (! stream->openedOk())
+            return false;
+
+        // 32-bit WAVs are written as IEEE float, so the golden is lossless.
+        juce::WavAudioFormat format;
+        std::unique_ptr<juce::AudioFormatWriter> writer (format.createWriterFor (stream.get(), sampleRate,
+                                                                                 (unsigned int) buffer.getNumChannels(),
+                                                                                 32, {}, 0));
+
+        if (writer == nullptr)
+            return false;
+
+        stream.release();
+        return writer->writeFromAudioSampleBuffer (buffer, 0, buffer.getNumSamples());
+    }
+
+    juce::AudioBuffer<float> readWav (const juce::File& file)
+    {
+        juce::WavAudioFormat format;
+        std::unique_ptr<juce::AudioFormatReader> reader (format.createReaderFor (file.createInputStream().release(), true));
+
+        if (reader == nullptr)
+            return {};
+
+        juce::AudioBuffer<float> buffer ((int) reader->numChannels, (int) reader->lengthInSamples);
+        reader->read (&buffer, 0, buffer.getNumSamples(), 0, true, true);
+        return buffer;
+    }
+} // namespace
+
+//==============================================================================
+Options& Options::get()
+{
+    static Options options;
+    return options;
+}
+
+//==============================================================================
+double NullResult::getMaxErrorDecibels() const
+{
+    return juce::Decibels::gainToDecibels (maxAbsoluteError, -300.0);
+}
+
+NullResult NullResult::compare (const juce::AudioBuffer<float>& actual, const juce::AudioBuffer<float>& expected)
+{
+    NullResult result;
+
+    if (actual.getNumChannels() != expected.getNumChannels()
+        || actual.getNumSamples() != expected.getNumSamples())
+    {
+        result.maxAbsoluteError = result.rmsError = std::numeric_limits<double>::infinity();
+        return result;
+    }
+
+    double sumOfSquares = 0.0;
+
+    for (int channel = 0; channel < actual.getNumChannels(); ++channel)
+    {
+        const auto* a = actual.getReadPointer (channel);
+        const auto* e = expected.getReadPointer (channel);
+
+        for (int i = 0; i < actual.getNumSamples(); ++i)
+        {
+            const auto error = std::abs ((double) a[i] - (double) e[i]);
+
+            result.maxAbsoluteError = juce::jmax (result.maxAbsoluteError, error);
+            sumOfSquares += error * error;
+        }
+    }
+
+    const auto numValues = actual.getNumChannels() * actual.getNumSamples();
+
+    if (numValues > 0)
+        result.rmsError = std::sqrt (sumOfSquares / (double) numValues);
+
+    return result;
+}
+
+//==============================================================================
+RegressionTest::RegressionTest (const juce::String& testName, const juce::String& testCategory)
+    : juce::UnitTest (testName, testCategory)
+{
+}
+
+int RegressionTest::getNumChecked() noexcept
+{
+    return numChecked;
+}
+
+int RegressionTest::getNumSkipped() noexcept
+{
+    return numSkipped;
+}
+
+void RegressionTest::skip (const juce::String& reason)
+{
+    ++numSkipped;
+    logMessage ("SKIPPED: " + reason);
+}
+
+void RegressionTest::expectNull (const juce::AudioBuffer<float>& actual, const juce::AudioBuffer<float>& expected,
+                                 double maxErrorDecibels, const juce::String& what)
+{
+    ++numChecked;
+
+    const auto result = NullResult::compare (actual, expected);
+
+    logMessage (what + ": max error " + juce::String (result.getMaxErrorDecibels(), 1) + " dBFS, rms error "
+                + juce::String (juce::Decibels::gainToDecibels (result.rmsError, -300.0), 1) + " dBFS");
+
+    expect (result.getMaxErrorDecibels() <= maxErrorDecibels,
+            what + " does not null to within " + juce::String (maxErrorDecibels, 1) + " dBFS");
+}
+
+void RegressionTest::expectMatchesGolden (const juce::String& goldenName, const juce::AudioBuffer<float>& actual,
+                                          double sampleRate, double maxErrorDecibels)
+{
+    const auto file = Options::get().goldenDirectory.getChildFile (goldenName + ".wav");
+
+    if (Options::get().record)
+    {
+        ++numChecked;
+        expect (writeWav (file, actual, sampleRate), "Could not write " + file.getFullPathName());
+        logMessage ("Recorded " + file.getFullPathName());
+        return;
+    }
+
+    if (! file.existsAsFile())
+    {
+        skip ("no golden render at " + file.getFullPathName() + "; build stoneydsp_tests_record to create it");
+        return;
+    }
+
+    expectNull (actual, readWav (file), maxErrorDecibels, goldenName);
+}
+
+void RegressionTest::expectThroughput (const juce::String& baselineName, double samplesPerSecond)
+{
+   #if JUCE_DEBUG
+    juce::ignoreUnused (samplesPerSecond);
+    skip (baselineName + ": throughput is not measured in debug builds");
+   #else
+    const auto& options = Options::get();
+    const juce::Identifier key (baselineName);
+
+    auto baselines = options.baselineFile.existsAsFile() ? juce::JSON::parse (options.baselineFile) : juce::var();
+
+    if (options.record)
+    {
+        juce::DynamicObject::Ptr object = baselines.getDynamicObject();
+
+        if (object == nullptr)
+            object = new juce::DynamicObject();
+
+        object->setProperty (key, samplesPerSecond);
+
+        ++numChecked;
+        expect (options.baselineFile.getParentDirectory().createDirectory().wasOk()
+                    && options.baselineFile.replaceWithText (juce::JSON::toString (juce::var (object.get()))),
+                "Could not write " + options.baselineFile.getFullPathName());
+        logMessage ("Recorded " + baselineName + " = " + juce::String (samplesPerSecond, 0) + " samples/s");
+        return;
+    }
+
+    if (! baselines.hasProperty (key))
+    {
+        skip ("no throughput baseline for " + baselineName + " in " + options.baselineFile.getFullPathName()
+              + "; build stoneydsp_tests_record to create it");
+        return;
+    }
+
+    ++numChecked;
+
+    const auto baseline = (double) baselines[key];
+    const auto minimum = baseline * (1.0 - options.throughputTolerance);
+
+    logMessage (baselineName + ": " + juce::String (samplesPerSecond, 0) + " samples/s, baseline "
+                + juce::String (baseline, 0) + " samples/s ("
+                + juce::String (100.0 * (samplesPerSecond / baseline - 1.0), 1) + "%)");
+
+    expect (samplesPerSecond >= minimum,
+            baselineName + " throughput dropped more than "
+            + juce::String (100.0 * options.throughputTolerance, 0) + "% below its baseline");
+   #endif
+}
+
+double RegressionTest::measureThroughput (const std::function<void()>& renderBlock, int samplesPerBlock,
+                                          int numBlocks, int numRuns)
+{
+    for (int block = 0; block < numBlocks; ++block)
+        renderBlock();
+
+    double best = 0.0;
+
+    for (int run = 0; run < numRuns; ++run)
+    {
+        const auto start = juce::Time::getHighResolutionTicks();
+
+        for (int block = 0; block < numBlocks; ++block)
+            renderBlock();
+
+        const auto seconds = juce::Time::highResolutionTicksToSeconds (juce::Time::getHighResolutionTicks() - start);
+
+        if (seconds > 0.0)
+            best = juce::jmax (best, (double) samplesPerBlock * (double) numBlocks / seconds);
+    }
+
+    return best;
+}
+
+} // namespace Tests
+} // namespace StoneyDSP
@@ -0,0 +1,87 @@
+/***************************************************************************//**
+ * @file main.cpp
+ * @author Nathan J. Hood <nathanjhood@googlemail.com>
+ * @brief Entry point of the StoneyDSP regression test runner.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+#include "StoneyDSPTests/harness.h"
+
+#include <iostream>
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    const juce::ArgumentList args (argc, argv);
+    const auto workingDirectory = juce::File::getCurrentWorkingDirectory();
+
+    auto& options = StoneyDSP::Tests::Options::get();
+
+    options.goldenDirectory = workingDirectory.getChildFile (args.getValueForOption ("--golden-dir"));
+    options.baselineFile = workingDirectory.getChildFile (args.getValueForOption ("--baseline-file"));
+    options.record = args.containsOption ("--record");
+
+    if (args.containsOption ("--throughput-tolerance"))
+        options.throughputTolerance = args.getValueForOption ("--throughput-tolerance").getDoubleValue();
+
+    juce::UnitTestRunner runner;
+    runner.setAssertOnFailure (false);
+
+    const auto category = args.getValueForOption ("--category");
+
+    if (category.isEmpty())
+        runner.runAllTests();
+    else
+        runner.runTestsInCategory (category);
+
+    if (runner.getNumResults() == 0)
+    {
+        std::cerr << "No tests found in category '" << category << "'" << std::endl;
+        return 1;
+    }
+
+    int numFailures = 0;
+
+    for (int i = 0; i < runner.getNumResults(); ++i)
+        numFailures += runner.getResult (i)->failures;
+
+    const auto numChecked = StoneyDSP::Tests::RegressionTest::getNumChecked();
+    const auto numSkipped = StoneyDSP::Tests::RegressionTest::getNumSkipped();
+
+    if (numChecked + numSkipped > 0)
+        std::cout << numChecked << " regression checks compared, " << numSkipped << " skipped" << std::endl;
+
+    if (numFailures > 0)
+        return 1;
+
+    // Anything left uncompared (a missing golden or baseline) must not pass.
+    if (numSkipped > 0)
+        return 77;
+
+    return 0;
+}